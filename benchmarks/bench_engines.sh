@@ -220,6 +220,8 @@ bench_nitc_options "nullables" "" "--no-check-attr-isset" "--no-union-attribute"
 bench_nitc_options "linkboost" "" NOALL --trampoline-call --colors-are-symbols "--colors-are-symbols --trampoline-call" "--separate --link-boost" "--separate --colors-are-symbols --guard-call" "--separate --colors-are-symbols --direct-call-monomorph0" "--substitute-monomorph"
 bench_nitc_options "monomorph" "" --direct-call-monomorph0 --direct-call-monomorph
 
+bench_nitc_options "crossmodule" "" --lto --unity-build
+
 bench_nitc_options "misc" "" --log --typing-test-metrics --invocation-metrics --isset-checks-metrics --tables-metrics --no-stacktrace --release --debug #FIXME add --sloppy
 
 # sanitary just run the default configuration, this is used to check that `run_compiler` works.
@@ -235,6 +237,8 @@ function bench_nitc-e_gc()
 	NIT_GC_OPTION="malloc" run_compiler "nitc-e-malloc" ./nitc --erasure
 	prepare_res "$name-nitc-e-large.dat" "nitc-e-large" "nitc with --erasure and large"
 	NIT_GC_OPTION="large" run_compiler "nitc-e-large" ./nitc --erasure
+	prepare_res "$name-nitc-e-gen.dat" "nitc-e-gen" "nitc with --erasure and gen"
+	NIT_GC_OPTION="gen" run_compiler "nitc-e-gen" ./nitc --erasure
 	plot "$name.gnu"
 }
 bench_nitc-e_gc
@@ -24,6 +24,7 @@ benches="iteration
 concat
 substring
 index
+hash
 compiler
 basic"
 
@@ -41,6 +42,8 @@ function usage()
 	echo "Benches : "
 	echo "  index: indexed access benchmark"
 	echo "    - usage : index loops strlen_min strlen_inc strlen_max"
+	echo "  hash: lookup of string keys in a HashMap benchmark"
+	echo "    - usage : hash loops keys_min keys_inc keys_max"
 	echo "  concat: string concatenation benchmark"
 	echo "    - usage : concat loops strlen min_cct cct_inc max_cct"
 	echo "  iteration: iteration benchmark"
@@ -84,6 +87,37 @@ function bench_indexed_variant()
 	done
 }
 
+function bench_hash()
+{
+	if [ $# -lt 4 ]; then
+		echo "Wrong arguments for benchmark hash."
+		usage
+		exit
+	fi
+	echo "Generating executable hash_bench for variant $variant";
+
+	../../bin/nitc --global hash_bench.nit -D maxlen=$curr_maxln
+
+	bench_hash_variant "json" $1 $2 $3 $4
+	bench_hash_variant "ident" $1 $2 $3 $4
+
+	rm hash_bench
+}
+
+# $1: json or ident
+# $2: loops
+# $3: keys min
+# $4: keys inc
+# $5: keys max
+function bench_hash_variant()
+{
+	tmp="${variant}_$1"
+	prepare_res_lines out/hash/hash_$tmp.out $tmp $tmp
+	for i in `seq "$3" "$4" "$5"`; do
+		bench_command $i $tmp$i ./hash_bench -m $1 --loops $2 --keys $i
+	done
+}
+
 function bench_concat()
 {
 	if [ $# -lt 5 ]; then
@@ -22,7 +22,7 @@
 	#define PRINT_ERROR(...) ((void)fprintf(stderr, __VA_ARGS__))
 #endif
 
-enum gc_option { gc_opt_large, gc_opt_malloc, gc_opt_boehm } gc_option;
+enum gc_option { gc_opt_large, gc_opt_malloc, gc_opt_boehm, gc_opt_gen } gc_option;
 
 #ifdef WITH_LIBGC
 	#include <gc.h>
@@ -31,35 +31,60 @@ enum gc_option { gc_opt_large, gc_opt_malloc, gc_opt_boehm } gc_option;
 void *nit_raw_alloc(size_t s0)
 {
 	switch (gc_option) {
-	case gc_opt_malloc: return malloc(s0);
+	case gc_opt_malloc: return calloc(1, s0);
 #ifdef WITH_LIBGC
-	case gc_opt_boehm: return GC_MALLOC_ATOMIC(s0);
+	case gc_opt_boehm:
+	case gc_opt_gen:
+		/* Atomic memory is neither scanned nor cleared by the GC */
+		return memset(GC_MALLOC_ATOMIC(s0), 0, s0);
 #endif
 
 	default: return nit_alloc(s0);
 	}
 }
 
+/* Per-thread storage of the allocation buffers of `large_alloc` */
+#if defined(TARGET_OS_IPHONE)
+	/* No `__thread` there (see `getCatchStack`), buffers are shared */
+	#define NIT_THREAD_LOCAL
+#else
+	#define NIT_THREAD_LOCAL __thread
+#endif
+
+/* Size of the allocation buffers of `large_alloc` */
+#define LARGE_BUFFER_SIZE (1024*1024)
+
+/* Current allocation buffer of the thread */
+static NIT_THREAD_LOCAL char *large_pos = NULL;
+
+/* Free space left in the current allocation buffer of the thread */
+static NIT_THREAD_LOCAL size_t large_size = 0;
+
+/* Bump pointer allocation in a buffer owned by the current thread.
+ *
+ * Threads do not share buffers, so they allocate without synchronization.
+ * Big objects get their own memory area so the current buffer is not wasted. */
 static void *large_alloc(size_t s0)
 {
-	static char * alloc_pos = NULL;
-	static size_t alloc_size = 0;
 	void * res;
-	size_t s = ((s0+3)/4)*4;
-	if(alloc_size < s) {
-		alloc_size = s + 1024*1024;
-		alloc_pos = (char *)calloc(alloc_size, 1);
+	/* Keep the alignment of pointers and doubles */
+	size_t s = (s0 + 7) & ~(size_t)7;
+	if(large_size < s) {
+		if (s > LARGE_BUFFER_SIZE / 4) return calloc(s, 1);
+		large_size = LARGE_BUFFER_SIZE;
+		large_pos = (char *)calloc(large_size, 1);
 	}
-	res = alloc_pos;
-	alloc_size -= s;
-	alloc_pos += s;
+	res = large_pos;
+	large_size -= s;
+	large_pos += s;
 	return res;
 }
 
 void nit_gcollect(void) {
 	switch (gc_option) {
 #ifdef WITH_LIBGC
-	case gc_opt_boehm: GC_gcollect(); break;
+	case gc_opt_boehm:
+	case gc_opt_gen: GC_gcollect(); break;
 #endif
 	default: break; /* nothing can be done */
 	}
@@ -69,7 +94,8 @@ void *nit_alloc(size_t s0)
 {
 	switch (gc_option) {
 #ifdef WITH_LIBGC
-	case gc_opt_boehm: return GC_MALLOC(s0);
+	case gc_opt_boehm:
+	case gc_opt_gen: return GC_MALLOC(s0);
 #endif
 	case gc_opt_malloc: return calloc(1, s0);
 	case gc_opt_large:
@@ -96,6 +122,12 @@ void initialize_gc_option(void) {
 			gc_option = gc_opt_boehm;
 #else
 		PRINT_ERROR( "Compiled without Boehm GC support. Using default '%s'.\n", def);
+#endif
+		} else if (strcmp(opt, "gen")==0) {
+#ifdef WITH_LIBGC
+			gc_option = gc_opt_gen;
+#else
+		PRINT_ERROR( "Compiled without Boehm GC support. Using default '%s'.\n", def);
 #endif
 		} else if (strcmp(opt, "malloc")==0) {
 			gc_option = gc_opt_malloc;
@@ -104,7 +136,7 @@ void initialize_gc_option(void) {
 		} else if (strcmp(opt, "help")==0) {
 			PRINT_ERROR( "NIT_GC_OPTION accepts 'malloc', 'large'"
 #ifdef WITH_LIBGC
-					", 'boehm'"
+					", 'boehm', 'gen'"
 #endif
 					". Default is '%s'.\n", def);
 			exit(1);
@@ -117,6 +149,13 @@ void initialize_gc_option(void) {
 	switch(gc_option) {
 #ifdef WITH_LIBGC
 		case gc_opt_boehm: GC_INIT(); break;
+		case gc_opt_gen:
+			GC_INIT();
+			/* Generational and incremental mode: minor collections only visit
+			 * the pages written since the last collection and the work of major
+			 * collections is interleaved with the allocations. */
+			GC_enable_incremental();
+			break;
 #endif
 		default: break; /* Nothing */
 	}
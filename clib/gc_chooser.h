@@ -16,7 +16,7 @@
 
 /* GC and memory management */
 void *nit_alloc(size_t); /* allocate memory to store an object with an object header */
-void *nit_raw_alloc(size_t); /* allocate raw memory to store a raw stram of byte */
+void *nit_raw_alloc(size_t); /* allocate zeroed memory that never references objects (bytes, boxed numbers) */
 void nit_gcollect(void); /* force a garbage collection */
 void initialize_gc_option(void); /* Select the wanted GC using envvar `NIT_GC_OPTION` */
 
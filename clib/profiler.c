@@ -0,0 +1,161 @@
+/* This file is part of NIT ( http://www.nitlanguage.org ).
+ *
+ * This file is free software, which comes along with NIT.  This software is
+ * distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without  even  the implied warranty of  MERCHANTABILITY or  FITNESS FOR A
+ * PARTICULAR PURPOSE.  You can modify it is you want,  provided this header
+ * is kept unaltered, and a notification of the changes is added.
+ * You  are  allowed  to  redistribute it and sell it, alone or is a part of
+ * another product.
+ */
+
+/* Sampling profiler
+ *
+ * A `SIGPROF` timer interrupts the program `NIT_PROFILE_HZ` times per second of CPU.
+ * On each signal, the C call stack is captured and counted in a fixed table.
+ * At exit, the C functions are mapped back to Nit methods (see `get_nit_name`)
+ * and the stacks are written to `cpu_profile.folded` in the collapsed format
+ * of flame graphs: one line per stack, root first, then the number of samples.
+ */
+
+#define _GNU_SOURCE
+#include "profiler.h"
+#include "c_functions_hash.h"
+#include <dlfcn.h>
+#include <errno.h>
+#include <execinfo.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/time.h>
+
+/* Maximal number of frames of a stack, deeper frames are lost */
+#define NIT_PROFILE_DEPTH 64
+/* Number of distinct stacks that can be recorded */
+#define NIT_PROFILE_STACKS 8192
+/* Number of probes to find a stack in the table */
+#define NIT_PROFILE_PROBES 64
+
+struct nit_profile_stack {
+	long count;
+	int depth;
+	void *ips[NIT_PROFILE_DEPTH];
+};
+
+static struct nit_profile_stack *nit_profile_stacks;
+static long nit_profile_lost;
+static volatile int nit_profile_busy;
+
+/* Count the current stack, called on `SIGPROF` */
+static void nit_profile_handler(int signo) {
+	void *ips[NIT_PROFILE_DEPTH + 2];
+	int saved_errno = errno;
+	int depth, i, k;
+	unsigned long h;
+
+	/* Threads are sampled too, but only one at a time */
+	if (__sync_lock_test_and_set(&nit_profile_busy, 1)) {
+		nit_profile_lost++;
+		return;
+	}
+
+	/* Skip the frames of the handler and of the signal trampoline */
+	depth = backtrace(ips, NIT_PROFILE_DEPTH + 2) - 2;
+	if (depth < 0) depth = 0;
+	h = depth;
+	for (i = 2; i < depth + 2; i++) h = h * 31 + (unsigned long)ips[i];
+
+	for (k = 0; k < NIT_PROFILE_PROBES; k++) {
+		struct nit_profile_stack *s = &nit_profile_stacks[(h + k) % NIT_PROFILE_STACKS];
+		if (s->count == 0) {
+			s->depth = depth;
+			memcpy(s->ips, ips + 2, depth * sizeof(void*));
+			s->count = 1;
+			break;
+		}
+		if (s->depth == depth && memcmp(s->ips, ips + 2, depth * sizeof(void*)) == 0) {
+			s->count++;
+			break;
+		}
+	}
+	if (k == NIT_PROFILE_PROBES) nit_profile_lost++;
+
+	__sync_lock_release(&nit_profile_busy);
+	errno = saved_errno;
+}
+
+/* Write the name of the function at `ip`, the Nit name if any */
+static void nit_profile_write_frame(FILE *f, void *ip) {
+	Dl_info info;
+	const char *name;
+	const char *loc;
+	/* `ip` is a return address, `ip-1` is in the caller */
+	if (dladdr((char*)ip - 1, &info) == 0 || info.dli_sname == NULL) {
+		fputs("?", f);
+		return;
+	}
+	name = get_nit_name(info.dli_sname, strlen(info.dli_sname));
+	if (name == NULL) {
+		fputs(info.dli_sname, f);
+		return;
+	}
+	/* Drop the location of the method */
+	loc = strstr(name, " (");
+	if (loc == NULL) fputs(name, f);
+	else fprintf(f, "%.*s", (int)(loc - name), name);
+}
+
+/* Stop the sampling and write the profile */
+static void nit_profile_dump(void) {
+	struct itimerval timer;
+	FILE *f;
+	int i, j;
+
+	memset(&timer, 0, sizeof(timer));
+	setitimer(ITIMER_PROF, &timer, NULL);
+	signal(SIGPROF, SIG_IGN);
+
+	f = fopen("cpu_profile.folded", "w");
+	if (f == NULL) return;
+	for (i = 0; i < NIT_PROFILE_STACKS; i++) {
+		struct nit_profile_stack *s = &nit_profile_stacks[i];
+		if (s->count == 0) continue;
+		for (j = s->depth - 1; j >= 0; j--) {
+			nit_profile_write_frame(f, s->ips[j]);
+			if (j > 0) fputc(';', f);
+		}
+		fprintf(f, " %ld\n", s->count);
+	}
+	if (nit_profile_lost > 0) fprintf(f, "[lost] %ld\n", nit_profile_lost);
+	fclose(f);
+}
+
+void nit_profile_start(void) {
+	struct itimerval timer;
+	struct sigaction action;
+	void *warmup[1];
+	long hz = 100;
+	char *opt = getenv("NIT_PROFILE_HZ");
+	if (opt != NULL && atol(opt) > 0) hz = atol(opt);
+
+	nit_profile_stacks = calloc(NIT_PROFILE_STACKS, sizeof(struct nit_profile_stack));
+	if (nit_profile_stacks == NULL) return;
+
+	/* The first call of `backtrace` may load libraries, it is not safe in a signal handler */
+	backtrace(warmup, 1);
+
+	memset(&action, 0, sizeof(action));
+	action.sa_handler = nit_profile_handler;
+	action.sa_flags = SA_RESTART;
+	sigemptyset(&action.sa_mask);
+	sigaction(SIGPROF, &action, NULL);
+
+	timer.it_interval.tv_sec = 0;
+	timer.it_interval.tv_usec = 1000000 / hz;
+	if (timer.it_interval.tv_usec == 0) timer.it_interval.tv_usec = 1;
+	timer.it_value = timer.it_interval;
+	setitimer(ITIMER_PROF, &timer, NULL);
+
+	atexit(nit_profile_dump);
+}
@@ -0,0 +1,18 @@
+#ifndef NIT_PROFILER_H
+#define NIT_PROFILER_H
+
+/* This file is part of NIT ( http://www.nitlanguage.org ).
+ *
+ * This file is free software, which comes along with NIT.  This software is
+ * distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without  even  the implied warranty of  MERCHANTABILITY or  FITNESS FOR A
+ * PARTICULAR PURPOSE.  You can modify it is you want,  provided this header
+ * is kept unaltered, and a notification of the changes is added.
+ * You  are  allowed  to  redistribute it and sell it, alone or is a part of
+ * another product.
+ */
+
+/* Sampling profiler, enabled by `nitc --profile` */
+void nit_profile_start(void); /* Start the sampling, the profile is written at exit */
+
+#endif
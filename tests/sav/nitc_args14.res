@@ -0,0 +1,6 @@
+true a 0xc8 10 -300 false -5 4000000000 null 5
+false z 0x07 10 12 true -5 4000000000 null 5
+true a 0xc8 10 -300 false -5 4000000000 null 5
+true 0x01 65000 true
+true a 0xc8 10 -300 true 127 4000000000 3 5
+true 0xff 3 true
@@ -0,0 +1,7 @@
+10
+2
+10
+[1,2,3,4,10]
+203
+0
+12
@@ -0,0 +1,7 @@
+102
+p(8,7)
+p(0,0) p(1,1) p(2,2)
+p(1,1) p(2,2) p(3,3)
+2
+2000
+3
@@ -0,0 +1,13 @@
+base_simple.nit
+base_simple3.nit
+base_simple_import.nit
+test_prog/rpg/careers.nit
+test_prog/rpg/character.nit
+test_prog/rpg/combat.nit
+test_prog/game/game.nit
+test_prog/examples/game_examples.nit
+test_prog/platform/platform.nit
+test_prog/rpg/races.nit
+test_prog/rpg/rpg.nit
+test_prog/tests/test_game.nit
+test_prog/test_prog.nit
@@ -0,0 +1,24 @@
+52
+null
+finish outer
+15
+9
+2
+-1
+x3
+1
+xynone
+12
+11
+10
+16
+15
+16
+1002
+true
+[0,1,9]
+3
+4
+68
+a=1
+b=2
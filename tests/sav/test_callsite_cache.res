@@ -0,0 +1,4 @@
+AAA
+ABAB
+ABADBDBFGHGHGAB
+HGHGHGFA
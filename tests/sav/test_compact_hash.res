@@ -0,0 +1,61 @@
+* test 1 *
+2 - 4
+20 - 4
+true
+true
+true
+true
+true
+true
+2
+0
+* test 2 *
+100
+34
+* test 3 *
+* start:
+true
+true
+true
+true
+true
+true
+true
+true
+true
+* add some:
+true
+true
+true
+true
+true
+true
+true
+true
+true
+true
+bleu, rouge, rose, jaune, orange, noir, gris, gris, blanc
+* remove:
+true
+true
+true
+true
+true
+true
+true
+rouge, jaune, orange, noir, blanc
+true
+* compare *
+342 342 true true
+412 412 true true
+454 454 true true
+501 501 true true
+441 441 true true
+513 513 true true
+448 448 true true
+513 513 true true
+449 449 true true
+513 513 true true
+0 true false 0 false
+1 10 1
+true false 0
@@ -0,0 +1,19 @@
+[0,1,4,-1,9,16,25,36,49,64,100,121,144,169,196,225,256,289,324,361]
+true
+-1
+0 1 4 -1 9 16 25 36 49 64 100 121 144 169 196 225 256 289 324 361
+[0.5,1.5,2.25,-3.0,4.0]
+5.25
+0.5 1.5 2.25 -3.0 4.0
+0.5
+[0.5,9.75,2.25,-3.0,4.0]
+[4.0,-3.0,2.25,9.75,0.5]
+[0xfa,0xfb,0xfc,0xfd,0xfe,0xff,0x00,0x01,0x02,0x03]
+0xfa 0xfb 0xfc 0xfd 0xfe 0xff 0x00 0x01 0x02 0x03
+[0,1,4,-1,9,16,25,36,49,64,100,121,144,169,196,225,256,289,324,361,0.5,9.75,2.25,-3.0,4.0,0xfa,0xfb,0xfc,0xfd,0xfe,0xff,0x00,0x01,0x02,0x03]
+40
+[0,1,4,-1,9,16,25,36,49,64,100,121,144,169,196,225,256,289,324,361,]
+4.0, -3.0, 2.25, 9.75, 0.5
+10.5
+7
+[-1.0,0.0,3.25,5.5]
@@ -10,19 +10,19 @@ number of get and has_key: 1
 number of collisions: 0 (0.00%)
 average length of collisions: NA
 average length of considered collections: 0.00
-average capacity of considered collections: 17.00 (NA%)
+average capacity of considered collections: 16.00 (NA%)
 
 STORE:
 number of stores: 1
 number of collisions: 0 (0.00%)
 average length of collisions: NA
 average length of considered collections: 0.00
-average capacity or considered collections: 17.00 (NA%)
+average capacity or considered collections: 16.00 (NA%)
 
 ENLARGE:
 number of enlarge: 1
 average length of considered collections: 0.00
-average capacity or considered collections: 17.00 (NA%)
+average capacity or considered collections: 16.00 (NA%)
 ~~~~~~
 ~~~Hash statistics~~~
 GET:
@@ -30,19 +30,19 @@ number of get and has_key: 2
 number of collisions: 0 (0.00%)
 average length of collisions: NA
 average length of considered collections: 0.50
-average capacity of considered collections: 17.00 (3400.00%)
+average capacity of considered collections: 16.00 (3200.00%)
 
 STORE:
 number of stores: 1
 number of collisions: 0 (0.00%)
 average length of collisions: NA
 average length of considered collections: 0.00
-average capacity or considered collections: 17.00 (NA%)
+average capacity or considered collections: 16.00 (NA%)
 
 ENLARGE:
 number of enlarge: 1
 average length of considered collections: 0.00
-average capacity or considered collections: 17.00 (NA%)
+average capacity or considered collections: 16.00 (NA%)
 ~~~~~~
 true
 ~~~Hash statistics~~~
@@ -51,19 +51,19 @@ number of get and has_key: 2
 number of collisions: 0 (0.00%)
 average length of collisions: NA
 average length of considered collections: 0.50
-average capacity of considered collections: 17.00 (3400.00%)
+average capacity of considered collections: 16.00 (3200.00%)
 
 STORE:
 number of stores: 1
 number of collisions: 0 (0.00%)
 average length of collisions: NA
 average length of considered collections: 0.00
-average capacity or considered collections: 17.00 (NA%)
+average capacity or considered collections: 16.00 (NA%)
 
 ENLARGE:
 number of enlarge: 1
 average length of considered collections: 0.00
-average capacity or considered collections: 17.00 (NA%)
+average capacity or considered collections: 16.00 (NA%)
 ~~~~~~
 
 a2
@@ -74,19 +74,19 @@ number of get and has_key: 3
 number of collisions: 0 (0.00%)
 average length of collisions: NA
 average length of considered collections: 0.67
-average capacity of considered collections: 17.00 (2550.00%)
+average capacity of considered collections: 16.00 (2400.00%)
 
 STORE:
 number of stores: 1
 number of collisions: 0 (0.00%)
 average length of collisions: NA
 average length of considered collections: 0.00
-average capacity or considered collections: 17.00 (NA%)
+average capacity or considered collections: 16.00 (NA%)
 
 ENLARGE:
 number of enlarge: 1
 average length of considered collections: 0.00
-average capacity or considered collections: 17.00 (NA%)
+average capacity or considered collections: 16.00 (NA%)
 ~~~~~~
 ~~~Hash statistics~~~
 GET:
@@ -94,19 +94,19 @@ number of get and has_key: 4
 number of collisions: 0 (0.00%)
 average length of collisions: NA
 average length of considered collections: 0.75
-average capacity of considered collections: 17.00 (2266.67%)
+average capacity of considered collections: 16.00 (2133.33%)
 
 STORE:
 number of stores: 2
 number of collisions: 1 (50.00%)
 average length of collisions: 2.00
 average length of considered collections: 0.50
-average capacity or considered collections: 17.00 (3400.00%)
+average capacity or considered collections: 16.00 (3200.00%)
 
 ENLARGE:
 number of enlarge: 1
 average length of considered collections: 0.00
-average capacity or considered collections: 17.00 (NA%)
+average capacity or considered collections: 16.00 (NA%)
 ~~~~~~
 ~~~Hash statistics~~~
 GET:
@@ -114,19 +114,19 @@ number of get and has_key: 5
 number of collisions: 1 (20.00%)
 average length of collisions: 2.00
 average length of considered collections: 1.00
-average capacity of considered collections: 17.00 (1700.00%)
+average capacity of considered collections: 16.00 (1600.00%)
 
 STORE:
 number of stores: 2
 number of collisions: 1 (50.00%)
 average length of collisions: 2.00
 average length of considered collections: 0.50
-average capacity or considered collections: 17.00 (3400.00%)
+average capacity or considered collections: 16.00 (3200.00%)
 
 ENLARGE:
 number of enlarge: 1
 average length of considered collections: 0.00
-average capacity or considered collections: 17.00 (NA%)
+average capacity or considered collections: 16.00 (NA%)
 ~~~~~~
 true
 ~~~Hash statistics~~~
@@ -135,19 +135,19 @@ number of get and has_key: 5
 number of collisions: 1 (20.00%)
 average length of collisions: 2.00
 average length of considered collections: 1.00
-average capacity of considered collections: 17.00 (1700.00%)
+average capacity of considered collections: 16.00 (1600.00%)
 
 STORE:
 number of stores: 2
 number of collisions: 1 (50.00%)
 average length of collisions: 2.00
 average length of considered collections: 0.50
-average capacity or considered collections: 17.00 (3400.00%)
+average capacity or considered collections: 16.00 (3200.00%)
 
 ENLARGE:
 number of enlarge: 1
 average length of considered collections: 0.00
-average capacity or considered collections: 17.00 (NA%)
+average capacity or considered collections: 16.00 (NA%)
 ~~~~~~
 
 end
@@ -157,17 +157,17 @@ number of get and has_key: 5
 number of collisions: 1 (20.00%)
 average length of collisions: 2.00
 average length of considered collections: 1.00
-average capacity of considered collections: 17.00 (1700.00%)
+average capacity of considered collections: 16.00 (1600.00%)
 
 STORE:
 number of stores: 2
 number of collisions: 1 (50.00%)
 average length of collisions: 2.00
 average length of considered collections: 0.50
-average capacity or considered collections: 17.00 (3400.00%)
+average capacity or considered collections: 16.00 (3200.00%)
 
 ENLARGE:
 number of enlarge: 1
 average length of considered collections: 0.00
-average capacity or considered collections: 17.00 (NA%)
+average capacity or considered collections: 16.00 (NA%)
 ~~~~~~
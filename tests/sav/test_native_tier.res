@@ -0,0 +1,34 @@
+0 18 0 -1 0.0 0 0 -5
+1 6 1 -1 0.0 0 1 -5
+1 6 7 1002 1.0 1 3 -5
+2 18 2 1003 2.5 1 6 -5
+3 6 5 1004 4.25 2 10 -5
+5 6 8 1005 6.125 2 15 -5
+8 18 16 1006 8.062 3 21 -4
+13 6 3 1007 10.031 3 28 -3
+21 6 19 1008 12.016 4 36 -2
+34 18 6 1009 14.008 4 45 -1
+55 6 14 1010 16.004 5 55 0
+89 6 9 1011 18.002 5 66 1
+144 18 9 1012 20.001 6 78 2
+233 6 17 1013 22.0 6 91 3
+377 6 17 1014 24.0 7 105 4
+610 18 4 1015 26.0 7 120 5
+987 6 12 1016 28.0 8 136 5
+1597 6 20 1017 30.0 8 153 5
+2584 18 20 1018 32.0 9 171 5
+4181 6 7 1019 34.0 9 190 5
+n false
+a true
+t false
+i true
+v false
+e true
+  false
+t false
+i true
+e true
+r false
+say 1
+say 2
+say 3
@@ -0,0 +1,16 @@
+0x01 Byte true false false false
+0xff Byte true false false false
+-3 Int16 false true false false
+40000 UInt16 false false true false
+x Char false false false false
+true Bool false false false false
+-1152921504606846976 Int false false false true
+1.5 Float false false false false
+7 Int8 false false false false
+9
+true
+false
+true
+true
+124716
+-50
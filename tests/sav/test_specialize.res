@@ -0,0 +1,13 @@
+[0,1,4,9,16,25,36,49,64,81,100]
+385
+true
+9
+100
+81
+[1,3,5]
+9
+v3
+none
+0,1,2,3,4
+a:3, b:2, c:1
+[1.5,2.5,3.0]
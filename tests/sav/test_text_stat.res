@@ -4,18 +4,17 @@ Usage of Strings:
 Allocations, by type:
 		
 	-UnicodeFlatString = 0
-	-ASCIIFlatString = 31
-	-FlatBuffer = 2
+	-ASCIIFlatString = 24
+	-FlatBuffer = 0
 	-Concat = 0
 
 Calls to length, by type:
-	FlatString = 20
 Indexed accesses, by type:
 Calls to byte_length for each type:
-	FlatString = 45
+	FlatString = 32
 Calls to position for each type:
 Calls to bytepos for each type:
-Calls to first_byte on FlatString 50
-Calls to last_byte on FlatString 11
+Calls to first_byte on FlatString 111
+Calls to last_byte on FlatString 0
 Length of travel for index distribution:
 Byte length of the FlatStrings created: